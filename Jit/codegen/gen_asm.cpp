@@ -1435,7 +1435,7 @@ prepareForDeopt(const uint64_t* regs, Runtime* runtime, std::size_t deopt_idx) {
     // Python frame will be ignored during future attempts to materialize the
     // stack.
     _PyShadowFrame_SetOwner(sf_iter, PYSF_INTERP);
-    reifyFrame(frame_iter, deopt_meta, deopt_meta.frame_meta.at(i), regs);
+    reifyFrame(frame_iter, deopt_meta, *deopt_meta.frame_meta.at(i), regs);
     frame_iter = frame_iter->f_back;
     sf_iter = sf_iter->prev;
   }
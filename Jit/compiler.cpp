@@ -96,6 +96,7 @@ void Compiler::runPasses(
     PostPassFunction callback) {
   // SSAify must come first; nothing but SSAify should ever see non-SSA HIR.
   runPass<jit::hir::SSAify>(irfunc, callback);
+  runPass<jit::hir::CallReturnTypeSpecialization>(irfunc, callback);
   runPass<jit::hir::Simplify>(irfunc, callback);
   runPass<jit::hir::DynamicComparisonElimination>(irfunc, callback);
   runPass<jit::hir::GuardTypeRemoval>(irfunc, callback);
@@ -106,6 +107,7 @@ void Compiler::runPasses(
     runPass<jit::hir::BeginInlinedFunctionElimination>(irfunc, callback);
   }
   runPass<jit::hir::BuiltinLoadMethodElimination>(irfunc, callback);
+  runPass<jit::hir::BuildStringFusion>(irfunc, callback);
   runPass<jit::hir::DeadCodeElimination>(irfunc, callback);
   runPass<jit::hir::RefcountInsertion>(irfunc, callback);
   JIT_LOGIF(
@@ -219,6 +221,11 @@ std::unique_ptr<CompiledFunction> Compiler::Compile(
     return nullptr;
   }
 
+  hir::Type ret_type = hir::inferReturnType(*irfunc);
+  if (ret_type < hir::TObject) {
+    Runtime::get()->setInferredReturnType(preloader.code(), ret_type);
+  }
+
   JIT_DLOG("Finished compiling %s", fullname);
   if (nullptr != irfunc->compilation_phase_timer) {
     irfunc->compilation_phase_timer->end();
@@ -250,6 +257,7 @@ std::unique_ptr<CompiledFunction> Compiler::Compile(
         stack_size,
         spill_stack_size,
         irfunc->num_inlined_functions,
+        irfunc->num_refcount_ops_eliminated,
         std::move(irfunc),
         std::move(ngen));
   } else {
@@ -259,7 +267,8 @@ std::unique_ptr<CompiledFunction> Compiler::Compile(
         func_size,
         stack_size,
         spill_stack_size,
-        irfunc->num_inlined_functions);
+        irfunc->num_inlined_functions,
+        irfunc->num_refcount_ops_eliminated);
   }
 }
 
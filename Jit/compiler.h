@@ -24,13 +24,15 @@ class CompiledFunction {
       int func_size,
       int stack_size,
       int spill_stack_size,
-      int num_inlined_functions)
+      int num_inlined_functions,
+      int num_refcount_ops_eliminated)
       : entry_point_(entry),
         code_runtime_(code_runtime),
         code_size_(func_size),
         stack_size_(stack_size),
         spill_stack_size_(spill_stack_size),
-        num_inlined_functions_(num_inlined_functions) {}
+        num_inlined_functions_(num_inlined_functions),
+        num_refcount_ops_eliminated_(num_refcount_ops_eliminated) {}
 
   virtual ~CompiledFunction() {}
 
@@ -61,6 +63,9 @@ class CompiledFunction {
   int GetNumInlinedFunctions() const {
     return num_inlined_functions_;
   }
+  int GetNumRefcountOpsEliminated() const {
+    return num_refcount_ops_eliminated_;
+  }
 
  private:
   DISALLOW_COPY_AND_ASSIGN(CompiledFunction);
@@ -71,6 +76,7 @@ class CompiledFunction {
   int stack_size_;
   int spill_stack_size_;
   int num_inlined_functions_;
+  int num_refcount_ops_eliminated_;
 };
 
 // same as CompiledFunction class but keeps HIR and LIR classes for debug
@@ -84,6 +90,7 @@ class CompiledFunctionDebug : public CompiledFunction {
       int stack_size,
       int spill_stack_size,
       int num_inlined_functions,
+      int num_refcount_ops_eliminated,
       std::unique_ptr<hir::Function> irfunc,
       std::unique_ptr<codegen::NativeGenerator> ngen)
       : CompiledFunction(
@@ -92,7 +99,8 @@ class CompiledFunctionDebug : public CompiledFunction {
             func_size,
             stack_size,
             spill_stack_size,
-            num_inlined_functions),
+            num_inlined_functions,
+            num_refcount_ops_eliminated),
         irfunc_(std::move(irfunc)),
         ngen_(std::move(ngen)) {}
 
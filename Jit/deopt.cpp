@@ -9,7 +9,9 @@
 #include "Jit/runtime.h"
 #include "Jit/util.h"
 
+#include <mutex>
 #include <shared_mutex>
+#include <unordered_set>
 
 using jit::codegen::PhyLocation;
 
@@ -114,16 +116,16 @@ static void reifyLocalsplus(
     const DeoptMetadata& meta,
     const DeoptFrameMetadata& frame_meta,
     const MemoryView& mem) {
-  for (std::size_t i = 0; i < frame_meta.localsplus.size(); i++) {
-    auto value = meta.getLocalValue(i, frame_meta);
+  frame_meta.localsplus.forEach([&](std::size_t i, int idx) {
+    auto value = meta.getLiveValue(idx);
     if (value == nullptr) {
       // Value is dead
       Py_CLEAR(frame->f_localsplus[i]);
-      continue;
+      return;
     }
     PyObject* obj = mem.read(*value);
     Py_XSETREF(frame->f_localsplus[i], obj);
-  }
+  });
 }
 
 static void reifyStack(
@@ -132,8 +134,8 @@ static void reifyStack(
     const DeoptFrameMetadata& frame_meta,
     const MemoryView& mem) {
   frame->f_stacktop = frame->f_valuestack + frame_meta.stack.size();
-  for (int i = frame_meta.stack.size() - 1; i >= 0; i--) {
-    const auto& value = meta.getStackValue(i, frame_meta);
+  frame_meta.stack.forEach([&](std::size_t i, int idx) {
+    const auto& value = *meta.getLiveValue(idx);
     if (value.isLoadMethodResult()) {
       // When we are deoptimizing a JIT-compiled function that contains an
       // optimizable LoadMethod, we need to be able to know whether or not the
@@ -150,7 +152,7 @@ static void reifyStack(
       PyObject* obj = mem.read(value);
       frame->f_valuestack[i] = obj;
     }
-  }
+  });
 }
 
 Ref<> profileDeopt(
@@ -240,6 +242,75 @@ static DeoptReason getDeoptReason(const jit::hir::DeoptBase& instr) {
   }
 }
 
+namespace {
+
+struct DeoptFrameMetadataHash {
+  std::size_t operator()(const DeoptFrameMetadata& meta) const {
+    std::size_t hash = combineHash(
+        std::hash<PyCodeObject*>{}(meta.code),
+        std::hash<int>{}(meta.next_instr_offset));
+    hash = combineHash(hash, meta.localsplus.hash());
+    return combineHash(hash, meta.stack.hash());
+  }
+};
+
+// Interned frame metadata and encoded LiveValueIndices, and stats about them.
+// Both live until shutdown.
+std::unordered_set<DeoptFrameMetadata, DeoptFrameMetadataHash> s_frame_metas;
+std::unordered_set<std::string> s_index_lists;
+InternedDeoptStats s_interned_stats;
+std::mutex s_interned_mutex;
+
+} // namespace
+
+LiveValueIndices::LiveValueIndices(const std::vector<int>& values) {
+  if (values.empty()) {
+    return;
+  }
+  std::string bytes;
+  int64_t last = 0;
+  for (int value : values) {
+    JIT_DCHECK(value >= -1, "invalid live value index %d", value);
+    int64_t delta = value - last;
+    uint64_t zigzag = (static_cast<uint64_t>(delta) << 1) ^
+        static_cast<uint64_t>(delta >> 63);
+    do {
+      uint8_t byte = zigzag & 0x7f;
+      zigzag >>= 7;
+      bytes.push_back(zigzag == 0 ? byte : (byte | 0x80));
+    } while (zigzag != 0);
+    last = value;
+  }
+  size_ = values.size();
+
+  std::lock_guard<std::mutex> guard{s_interned_mutex};
+  s_interned_stats.num_index_lists++;
+  auto result = s_index_lists.emplace(std::move(bytes));
+  if (result.second) {
+    s_interned_stats.index_list_bytes +=
+        sizeof(std::string) + result.first->capacity();
+  }
+  bytes_ = &*result.first;
+}
+
+const DeoptFrameMetadata* internDeoptFrameMetadata(DeoptFrameMetadata&& meta) {
+  std::lock_guard<std::mutex> guard{s_interned_mutex};
+  s_interned_stats.num_frames++;
+  auto result = s_frame_metas.emplace(std::move(meta));
+  if (result.second) {
+    s_interned_stats.frame_bytes += result.first->memoryUsage();
+  }
+  return &*result.first;
+}
+
+InternedDeoptStats internedDeoptStats() {
+  std::lock_guard<std::mutex> guard{s_interned_mutex};
+  InternedDeoptStats stats = s_interned_stats;
+  stats.num_unique_frames = s_frame_metas.size();
+  stats.num_unique_index_lists = s_index_lists.size();
+  return stats;
+}
+
 DeoptMetadata DeoptMetadata::fromInstr(
     const jit::hir::DeoptBase& instr,
     CodeRuntime* code_rt) {
@@ -257,6 +328,7 @@ DeoptMetadata DeoptMetadata::fromInstr(
 #pragma GCC diagnostic pop
 
   std::unordered_map<jit::hir::Register*, int> reg_idx;
+  meta.live_values.reserve(instr.live_regs().size());
   int i = 0;
   for (const auto& reg_state : instr.live_regs()) {
     auto reg = reg_state.reg;
@@ -286,18 +358,20 @@ DeoptMetadata DeoptMetadata::fromInstr(
       [get_reg_idx](DeoptFrameMetadata& meta, hir::FrameState* fs) {
         std::size_t nlocals = fs->locals.size();
         std::size_t ncells = fs->cells.size();
-        meta.localsplus.resize(nlocals + ncells, -1);
+        std::vector<int> localsplus(nlocals + ncells, -1);
         for (std::size_t i = 0; i < nlocals; i++) {
-          meta.localsplus[i] = get_reg_idx(fs->locals[i]);
+          localsplus[i] = get_reg_idx(fs->locals[i]);
         }
         for (std::size_t i = 0; i < ncells; i++) {
-          meta.localsplus[nlocals + i] = get_reg_idx(fs->cells[i]);
+          localsplus[nlocals + i] = get_reg_idx(fs->cells[i]);
         }
+        meta.localsplus = LiveValueIndices{localsplus};
       };
 
   auto populate_stack = [get_reg_idx](
                             DeoptFrameMetadata& meta, hir::FrameState* fs) {
     std::unordered_set<jit::hir::Register*> lms_on_stack;
+    std::vector<int> stack;
     for (auto& reg : fs->stack) {
       if (reg->instr()->IsLoadMethod()) {
         // Our logic for reconstructing the Python stack assumes that if a
@@ -311,8 +385,9 @@ DeoptMetadata DeoptMetadata::fromInstr(
             result.second,
             "load method results may only appear in one stack slot");
       }
-      meta.stack.emplace_back(get_reg_idx(reg));
+      stack.emplace_back(get_reg_idx(reg));
     }
+    meta.stack = LiveValueIndices{stack};
   };
 
   auto fs = instr.frameState();
@@ -321,12 +396,14 @@ DeoptMetadata DeoptMetadata::fromInstr(
   meta.frame_meta.resize(num_frames + 1); // +1 for caller
   for (hir::FrameState* frame = fs; frame != NULL; frame = frame->parent) {
     int i = num_frames--;
+    DeoptFrameMetadata frame_meta;
     // Translate locals and cells
-    populate_localsplus(meta.frame_meta.at(i), frame);
-    populate_stack(meta.frame_meta.at(i), frame);
-    meta.frame_meta.at(i).block_stack = frame->block_stack;
-    meta.frame_meta.at(i).next_instr_offset = frame->next_instr_offset;
-    meta.frame_meta.at(i).code = frame->code.get();
+    populate_localsplus(frame_meta, frame);
+    populate_stack(frame_meta, frame);
+    frame_meta.block_stack = frame->block_stack;
+    frame_meta.next_instr_offset = frame->next_instr_offset;
+    frame_meta.code = frame->code.get();
+    meta.frame_meta.at(i) = internDeoptFrameMetadata(std::move(frame_meta));
   }
 
   if (hir::Register* guilty_reg = instr.guiltyReg()) {
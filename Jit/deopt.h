@@ -12,6 +12,8 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <initializer_list>
+#include <string>
 #include <vector>
 
 namespace jit {
@@ -98,17 +100,98 @@ enum class DeoptAction : char {
 
 const char* deoptActionName(DeoptAction action);
 
+// A list of indices into DeoptMetadata::live_values, where -1 means "dead".
+//
+// Frame states are mostly made up of runs of consecutive live values, so each
+// entry is stored as the zigzag-encoded difference from the previous entry,
+// in LEB128 varint form. The common case takes one byte per entry instead of
+// four. Entries are decoded on the fly while iterating.
+//
+// The encoded bytes are interned, so equal lists share storage (and compare
+// equal by pointer), and copying a LiveValueIndices is cheap.
+class LiveValueIndices {
+ public:
+  LiveValueIndices() = default;
+  explicit LiveValueIndices(const std::vector<int>& values);
+  LiveValueIndices(std::initializer_list<int> values)
+      : LiveValueIndices(std::vector<int>(values)) {}
+
+  std::size_t size() const {
+    return size_;
+  }
+
+  // Call func(i, value) for each entry, in order.
+  template <typename Func>
+  void forEach(Func func) const {
+    int value = 0;
+    std::size_t pos = 0;
+    for (std::size_t i = 0; i < size_; i++) {
+      uint64_t zigzag = 0;
+      int shift = 0;
+      uint8_t byte;
+      do {
+        byte = (*bytes_)[pos++];
+        zigzag |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        shift += 7;
+      } while (byte & 0x80);
+      value += static_cast<int>(
+          static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1));
+      func(i, value);
+    }
+  }
+
+  // Decode the entry at index i. This is linear in i; prefer forEach() when
+  // visiting more than one entry.
+  int at(std::size_t i) const {
+    JIT_DCHECK(i < size_, "index %d out of range", i);
+    int result = -1;
+    forEach([&](std::size_t j, int value) {
+      if (j == i) {
+        result = value;
+      }
+    });
+    return result;
+  }
+
+  // Number of bytes used to encode the entries. The storage is shared with
+  // all equal lists.
+  std::size_t encodedSize() const {
+    return bytes_ == nullptr ? 0 : bytes_->size();
+  }
+
+  std::size_t hash() const {
+    return std::hash<const std::string*>{}(bytes_);
+  }
+
+  bool operator==(const LiveValueIndices& other) const {
+    return bytes_ == other.bytes_;
+  }
+
+  bool operator!=(const LiveValueIndices& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  // Interned encoding of the entries, or nullptr if there are none.
+  const std::string* bytes_{nullptr};
+  uint32_t size_{0};
+};
+
 // Deopt metadata that is specific to a particular (shadow) frame whose code
 // may have been inlined.
+//
+// Adjacent guards usually describe identical frames, so instances created by
+// DeoptMetadata::fromInstr() are interned and shared between all
+// DeoptMetadatas that reference them; see internDeoptFrameMetadata().
 struct DeoptFrameMetadata {
   // Locals + cellvars + freevars. This contains an index into live_values or
   // -1 to indicate that a variable is dead. This is somewhat oddly named in
   // order to maintain the correspondence with the `f_localsplus` field on
   // `PyFrameObject`.
-  std::vector<int> localsplus;
+  LiveValueIndices localsplus;
 
   // Index into live_values for each entry in the operand stack.
-  std::vector<int> stack;
+  LiveValueIndices stack;
 
   jit::hir::BlockStack block_stack;
 
@@ -123,8 +206,41 @@ struct DeoptFrameMetadata {
     return std::max(
         next_instr_offset - static_cast<int>(sizeof(_Py_CODEUNIT)), -1);
   }
+
+  // Approximate number of bytes used by this object, including its own size
+  // but not the (shared) encoded live value indices.
+  std::size_t memoryUsage() const {
+    return sizeof(*this) + block_stack.size() * sizeof(jit::hir::ExecutionBlock);
+  }
+
+  bool operator==(const DeoptFrameMetadata& other) const {
+    return code == other.code &&
+        next_instr_offset == other.next_instr_offset &&
+        localsplus == other.localsplus && stack == other.stack &&
+        block_stack == other.block_stack;
+  }
+};
+
+// Return a canonical copy of the given frame metadata, which lives until
+// shutdown.
+const DeoptFrameMetadata* internDeoptFrameMetadata(DeoptFrameMetadata&& meta);
+
+// Memory used by all DeoptFrameMetadatas and LiveValueIndices interned so far.
+struct InternedDeoptStats {
+  // Number of calls to internDeoptFrameMetadata(), the number of distinct
+  // frames that are actually stored, and their size in bytes.
+  std::size_t num_frames{0};
+  std::size_t num_unique_frames{0};
+  std::size_t frame_bytes{0};
+
+  // The same, for non-empty LiveValueIndices.
+  std::size_t num_index_lists{0};
+  std::size_t num_unique_index_lists{0};
+  std::size_t index_list_bytes{0};
 };
 
+InternedDeoptStats internedDeoptStats();
+
 // DeoptMetadata captures all the information necessary to reconstruct a
 // PyFrameObject when deoptimization occurs.
 struct DeoptMetadata {
@@ -136,7 +252,8 @@ struct DeoptMetadata {
   std::vector<LiveValue> live_values;
 
   // Stack of inlined frame metadata unwound from the deopting instruction.
-  std::vector<DeoptFrameMetadata> frame_meta;
+  // These are usually interned, and must outlive this object.
+  std::vector<const DeoptFrameMetadata*> frame_meta;
 
   // Runtime metadata associated with the JIT-compiled function from which this
   // was generated.
@@ -165,17 +282,16 @@ struct DeoptMetadata {
     return frame_meta.size() - 1;
   }
 
-  const LiveValue& getStackValue(int i, const DeoptFrameMetadata& frame) const {
-    return live_values[frame.stack[i]];
+  const DeoptFrameMetadata& innermostFrame() const {
+    return *frame_meta.back();
   }
 
-  // Returns nullptr if local `i` is dead
-  const LiveValue* getLocalValue(int i, const DeoptFrameMetadata& frame) const {
-    int v = frame.localsplus[i];
-    if (v == -1) {
+  // Returns nullptr if `idx` is -1, meaning the value is dead.
+  const LiveValue* getLiveValue(int idx) const {
+    if (idx == -1) {
       return nullptr;
     }
-    return &live_values[v];
+    return &live_values[idx];
   }
 
   // Returns nullptr if there is no guilty value.
@@ -186,6 +302,13 @@ struct DeoptMetadata {
     return &live_values[guilty_value];
   }
 
+  // Approximate number of bytes used by this object, including its own size
+  // but not the (shared) frame metadata.
+  std::size_t memoryUsage() const {
+    return sizeof(*this) + live_values.capacity() * sizeof(LiveValue) +
+        frame_meta.capacity() * sizeof(frame_meta[0]);
+  }
+
   std::string toString() const {
     std::vector<std::string> live_value_strings;
     for (const LiveValue& lv : live_values) {
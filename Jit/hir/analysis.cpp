@@ -61,6 +61,7 @@ bool isPassthrough(const Instr& instr) {
     case Opcode::kBinaryOp:
     case Opcode::kBuildSlice:
     case Opcode::kBuildString:
+    case Opcode::kBuildStringFused:
     case Opcode::kCallCFunc:
     case Opcode::kCallEx:
     case Opcode::kCallExKw:
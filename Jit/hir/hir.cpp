@@ -116,6 +116,7 @@ bool Instr::isReplayable() const {
     case Opcode::kAssign:
     case Opcode::kBitCast:
     case Opcode::kBuildString:
+    case Opcode::kBuildStringFused:
     case Opcode::kCast:
     case Opcode::kCheckExc:
     case Opcode::kCheckField:
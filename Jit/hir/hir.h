@@ -292,6 +292,7 @@ struct FrameState {
   V(Branch)                            \
   V(BuildSlice)                        \
   V(BuildString)                       \
+  V(BuildStringFused)                  \
   V(CallCFunc)                         \
   V(CallEx)                            \
   V(CallExKw)                          \
@@ -3791,6 +3792,17 @@ DEFINE_SIMPLE_INSTR(
 // Implements BUILD_STRING opcode.
 DEFINE_SIMPLE_INSTR(BuildString, (TUnicode), HasOutput, Operands<>, DeoptBase);
 
+// Fused form of FormatValue + BuildString, produced by BuildStringFusion when
+// every piece of an f-string is an exact str or an exact int. The result is
+// written into a single new string without creating intermediate strs for the
+// int pieces.
+DEFINE_SIMPLE_INSTR(
+    BuildStringFused,
+    (TUnicodeExact | TLongExact),
+    HasOutput,
+    Operands<>,
+    DeoptBase);
+
 // Implements FORMAT_VALUE opcode, which handles f-string value formatting.
 class INSTR_CLASS(
     FormatValue,
@@ -4213,6 +4225,10 @@ class Function {
   // How many functions have been inlined into this function?
   int num_inlined_functions{0};
 
+  // How many Incref/Decref instructions were removed after refcount
+  // insertion?
+  int num_refcount_ops_eliminated{0};
+
   // vector of {locals_idx, type, optional}
   // in argument order, may have gaps for unchecked args
   std::vector<TypedArgument> typed_args;
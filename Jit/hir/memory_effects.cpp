@@ -32,6 +32,7 @@ MemoryEffects memoryEffects(const Instr& inst) {
     case Opcode::kBitCast:
     case Opcode::kBuildSlice:
     case Opcode::kBuildString:
+    case Opcode::kBuildStringFused:
     case Opcode::kCast:
     case Opcode::kDeopt:
     case Opcode::kDeoptPatchpoint:
@@ -14,10 +14,12 @@
 #include "Jit/hir/ssa.h"
 #include "Jit/jit_rt.h"
 #include "Jit/pyjit.h"
+#include "Jit/runtime.h"
 #include "Jit/util.h"
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <list>
 #include <memory>
 #include <unordered_map>
@@ -42,6 +44,8 @@ PassRegistry::PassRegistry() {
   addPass(GuardTypeRemoval::Factory);
   addPass(BeginInlinedFunctionElimination::Factory);
   addPass(BuiltinLoadMethodElimination::Factory);
+  addPass(BuildStringFusion::Factory);
+  addPass(CallReturnTypeSpecialization::Factory);
 }
 
 std::unique_ptr<Pass> PassRegistry::MakePass(const std::string& name) {
@@ -1113,5 +1117,205 @@ void BuiltinLoadMethodElimination::Run(Function& irfunc) {
   reflowTypes(irfunc);
 }
 
+// Return the value being formatted if the given FormatValue can be folded
+// into a BuildStringFused, or nullptr if it can't.
+static Register* fusableFormatValue(const FormatValue* instr) {
+  if (!instr->GetOperand(0)->isA(TNullptr)) {
+    return nullptr;
+  }
+  Register* value = instr->GetOperand(1);
+  int conversion = instr->conversion();
+  if (value->isA(TUnicodeExact)) {
+    return conversion == FVC_NONE || conversion == FVC_STR ? value : nullptr;
+  }
+  if (value->isA(TLongExact)) {
+    // format(), str(), repr() and ascii() all agree for exact ints.
+    return value;
+  }
+  return nullptr;
+}
+
+// Fuse build if possible, unlinking the instructions it replaces and adding
+// them to dead. They're freed once every BuildString has been looked at, since
+// they may also appear in users.
+static void tryFuseBuildString(
+    BuildString* build,
+    const std::unordered_map<Register*, std::vector<Instr*>>& users,
+    std::unordered_set<Instr*>& dead) {
+  std::vector<Register*> pieces;
+  std::vector<Instr*> format_values;
+  for (std::size_t i = 0; i < build->NumOperands(); i++) {
+    Register* operand = build->GetOperand(i);
+    if (operand->isA(TUnicodeExact)) {
+      pieces.push_back(operand);
+      continue;
+    }
+    if (!operand->instr()->IsFormatValue()) {
+      return;
+    }
+    auto fv = static_cast<FormatValue*>(operand->instr());
+    Register* value = fusableFormatValue(fv);
+    if (value == nullptr) {
+      return;
+    }
+    pieces.push_back(value);
+    format_values.push_back(fv);
+  }
+
+  // The formatted pieces are on the operand stack until BUILD_STRING runs, so
+  // they show up in the FrameStates of the FormatValues and Snapshots that
+  // follow them. We can only remove a FormatValue if those (which are also
+  // being removed) and the BuildString are its only users. Snapshots aren't
+  // deopt points, and this runs after the passes that look for them, so they
+  // can go.
+  std::vector<Instr*> snapshots;
+  for (Instr* fv : format_values) {
+    auto it = users.find(fv->GetOutput());
+    if (it == users.end()) {
+      continue;
+    }
+    for (Instr* user : it->second) {
+      if (dead.count(user)) {
+        return;
+      }
+      if (user->IsSnapshot()) {
+        if (std::find(snapshots.begin(), snapshots.end(), user) ==
+            snapshots.end()) {
+          snapshots.push_back(user);
+        }
+        continue;
+      }
+      if (user != build &&
+          std::find(format_values.begin(), format_values.end(), user) ==
+              format_values.end()) {
+        return;
+      }
+    }
+  }
+
+  auto fused = BuildStringFused::create(
+      pieces.size(), build->GetOutput(), *build->frameState());
+  for (std::size_t i = 0; i < pieces.size(); i++) {
+    fused->SetOperand(i, pieces[i]);
+  }
+  build->ReplaceWith(*fused);
+  dead.insert(build);
+
+  for (Instr* instr : snapshots) {
+    instr->unlink();
+    dead.insert(instr);
+  }
+  for (Instr* fv : format_values) {
+    fv->unlink();
+    dead.insert(fv);
+  }
+}
+
+void BuildStringFusion::Run(Function& irfunc) {
+  std::vector<BuildString*> builds;
+  std::unordered_map<Register*, std::vector<Instr*>> users;
+  for (auto& block : irfunc.cfg.blocks) {
+    for (auto& instr : block) {
+      instr.visitUses([&](Register* reg) {
+        users[reg].push_back(&instr);
+        return true;
+      });
+      if (instr.IsBuildString()) {
+        builds.push_back(static_cast<BuildString*>(&instr));
+      }
+    }
+  }
+  std::unordered_set<Instr*> dead;
+  for (BuildString* build : builds) {
+    tryFuseBuildString(build, users, dead);
+  }
+  for (Instr* instr : dead) {
+    delete instr;
+  }
+}
+
+void CallReturnTypeSpecialization::Run(Function& irfunc) {
+  Runtime* runtime = Runtime::get();
+  bool changed = false;
+  for (auto& block : irfunc.cfg.blocks) {
+    for (auto it = block.begin(); it != block.end();) {
+      Instr& instr = *it;
+      ++it;
+      if (!instr.IsVectorCall() && !instr.IsVectorCallKW()) {
+        continue;
+      }
+      auto call = static_cast<VectorCallBase*>(&instr);
+      Type target_type = call->func()->type();
+      if (!target_type.hasValueSpec(TFunc)) {
+        continue;
+      }
+      BorrowedRef<PyFunctionObject> func{target_type.objectSpec()};
+      Type ret_type = runtime->inferredReturnType(
+          reinterpret_cast<PyCodeObject*>(func->func_code));
+      Register* output = call->GetOutput();
+      if (!(ret_type < output->type())) {
+        continue;
+      }
+
+      // The call is the only instruction that depends on the callee, so
+      // deopting right before it is enough to protect everything downstream.
+      auto patcher =
+          runtime->allocateDeoptPatcher<FunctionModifiedDeoptPatcher>(func);
+      auto patchpoint = DeoptPatchpoint::create(patcher);
+      patchpoint->setFrameState(*call->frameState());
+      patchpoint->setDescr(
+          fmt::format("return type of {}", funcFullname(func)));
+      patchpoint->copyBytecodeOffset(*call);
+      patchpoint->InsertBefore(*call);
+
+      Register* result = irfunc.env.AllocateRegister();
+      call->SetOutput(result);
+      auto refine = RefineType::create(output, ret_type, result);
+      refine->copyBytecodeOffset(*call);
+      refine->InsertAfter(*call);
+      changed = true;
+    }
+  }
+  if (changed) {
+    reflowTypes(irfunc);
+  }
+}
+
+Type inferReturnType(const Function& func) {
+  if (func.code == nullptr || (func.code->co_flags & kCoFlagsAnyGenerator)) {
+    return TObject;
+  }
+  Type ret_type = TBottom;
+  for (auto& block : func.cfg.blocks) {
+    for (auto& instr : block) {
+      switch (instr.opcode()) {
+        // Anything that can deopt without raising an exception means the
+        // function may finish in the interpreter, where the types we inferred
+        // no longer hold.
+        case Opcode::kDeopt:
+        case Opcode::kDeoptPatchpoint:
+        case Opcode::kGuard:
+        case Opcode::kGuardIs:
+        case Opcode::kGuardType:
+          return TObject;
+        case Opcode::kReturn:
+          ret_type |= instr.GetOperand(0)->type();
+          break;
+        default:
+          break;
+      }
+    }
+  }
+  if (ret_type == TBottom || !(ret_type < TObject)) {
+    return TObject;
+  }
+  // Don't let callers depend on the identity or mortality of returned
+  // objects.
+  if (ret_type.hasObjectSpec()) {
+    ret_type = Type::fromTypeExact(ret_type.typeSpec());
+  }
+  return ret_type.dropMortality();
+}
+
 } // namespace hir
 } // namespace jit
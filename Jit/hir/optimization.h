@@ -200,6 +200,39 @@ class BuiltinLoadMethodElimination : public Pass {
   }
 };
 
+// Replace BuildString instructions whose pieces are all exact strs or
+// FormatValues of exact ints with a single BuildStringFused, removing the
+// FormatValues and the temporary strings they would have created.
+class BuildStringFusion : public Pass {
+ public:
+  BuildStringFusion() : Pass("BuildStringFusion") {}
+
+  void Run(Function& irfunc) override;
+
+  static std::unique_ptr<BuildStringFusion> Factory() {
+    return std::make_unique<BuildStringFusion>();
+  }
+};
+
+// Use the return types recorded for already-compiled callees to refine the
+// output types of calls to known functions. Each refined call is preceded by a
+// DeoptPatchpoint that invalidates the caller if the callee is modified.
+class CallReturnTypeSpecialization : public Pass {
+ public:
+  CallReturnTypeSpecialization() : Pass("CallReturnTypeSpecialization") {}
+
+  void Run(Function& irfunc) override;
+
+  static std::unique_ptr<CallReturnTypeSpecialization> Factory() {
+    return std::make_unique<CallReturnTypeSpecialization>();
+  }
+};
+
+// Compute the type of every value the given function can return, ignoring
+// functions whose return values depend on speculation (and would therefore
+// change if the function deopted). Returns TObject if nothing useful is known.
+Type inferReturnType(const Function& func);
+
 class PassRegistry {
  public:
   PassRegistry();
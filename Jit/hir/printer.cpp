@@ -235,6 +235,7 @@ static std::string format_immediates(const Instr& instr) {
     case Opcode::kBatchDecref:
     case Opcode::kBitCast:
     case Opcode::kBuildString:
+    case Opcode::kBuildStringFused:
     case Opcode::kCheckExc:
     case Opcode::kCheckNeg:
     case Opcode::kCheckSequenceBounds:
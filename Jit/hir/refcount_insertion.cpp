@@ -1170,6 +1170,141 @@ std::ostream& operator<<(std::ostream& os, const StateMap& regs) {
   return os << "}";
 }
 
+bool isIncref(const Instr& instr) {
+  return instr.IsIncref() || instr.IsXIncref();
+}
+
+bool isDecref(const Instr& instr) {
+  return instr.IsDecref() || instr.IsXDecref();
+}
+
+// Return true if an Incref of `model` can be moved past `instr`, or removed
+// together with a matching Decref on the other side of `instr`, without
+// changing behavior. Any Decref could release the object (possibly through an
+// alias), anything that may run arbitrary code could do the same, and deopts
+// have recorded the reference as owned.
+bool refcountTransparent(const Instr& instr, Register* model) {
+  if (isIncref(instr)) {
+    return true;
+  }
+  if (isDecref(instr) || instr.IsBatchDecref() ||
+      dynamic_cast<const DeoptBase*>(&instr) != nullptr) {
+    return false;
+  }
+  MemoryEffects effects = memoryEffects(instr);
+  if (effects.may_store != AEmpty) {
+    return false;
+  }
+  for (std::size_t i = 0; i < instr.NumOperands(); i++) {
+    if (effects.stolen_inputs.GetBit(i) &&
+        modelReg(instr.GetOperand(i)) == model) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Starting at `it`, look for a Decref of `model` that is only separated from
+// `it` by transparent instructions.
+Instr* findCancellingDecref(
+    BasicBlock* block,
+    Instr::List::iterator it,
+    Register* model) {
+  for (; it != block->end(); ++it) {
+    if (isDecref(*it) && modelReg(it->GetOperand(0)) == model) {
+      return &*it;
+    }
+    if (!refcountTransparent(*it, model)) {
+      return nullptr;
+    }
+  }
+  return nullptr;
+}
+
+// If `incref` can be pushed past the end of its block, and doing so lets it
+// cancel out against a Decref at the start of at least one successor, sink a
+// copy of it into each successor and remove the original.
+bool sinkIncref(Instr* incref) {
+  BasicBlock* block = incref->block();
+  Register* model = modelReg(incref->GetOperand(0));
+  auto it = std::next(block->iterator_to(*incref));
+  for (; it != block->end(); ++it) {
+    if (!refcountTransparent(*it, model)) {
+      return false;
+    }
+  }
+  std::vector<BasicBlock*> succs;
+  for (const Edge* edge : block->out_edges()) {
+    succs.push_back(edge->to());
+  }
+  bool cancels = false;
+  for (BasicBlock* succ : succs) {
+    // Critical edges have been split, so this only fails for blocks with a
+    // single successor that is also a join point.
+    if (succ->in_edges().size() != 1 || succ->front().IsPhi()) {
+      return false;
+    }
+    cancels |= findCancellingDecref(succ, succ->begin(), model) != nullptr;
+  }
+  if (!cancels) {
+    return false;
+  }
+  for (BasicBlock* succ : succs) {
+    Instr* copy = incref->clone();
+    copy->copyBytecodeOffset(*incref);
+    succ->push_front(copy);
+  }
+  incref->unlink();
+  delete incref;
+  return true;
+}
+
+// Clean up after RefcountInsertion: Increfs that are immediately (or after a
+// conditional branch) followed by a Decref of the same value are removed, and
+// Increfs are sunk into successor blocks when that exposes such a pair.
+//
+// Returns the number of refcount operations removed.
+int cancelRefcountPairs(Function& irfunc) {
+  std::vector<Instr*> increfs;
+  for (auto& block : irfunc.cfg.blocks) {
+    for (auto& instr : block) {
+      if (isIncref(instr)) {
+        increfs.push_back(&instr);
+      }
+    }
+  }
+  for (Instr* incref : increfs) {
+    sinkIncref(incref);
+  }
+
+  int num_removed = 0;
+  for (auto& block : irfunc.cfg.blocks) {
+    for (auto it = block.begin(); it != block.end();) {
+      Instr& instr = *it++;
+      if (!isIncref(instr)) {
+        continue;
+      }
+      // An XDecref can consume an Incref, but a Decref can't consume an
+      // XIncref, since the value may be null.
+      Register* model = modelReg(instr.GetOperand(0));
+      Instr* decref = findCancellingDecref(
+          &block, std::next(block.iterator_to(instr)), model);
+      if (decref == nullptr || (instr.IsXIncref() && decref->IsDecref())) {
+        continue;
+      }
+      if (&*it == decref) {
+        ++it;
+      }
+      instr.unlink();
+      delete &instr;
+      decref->unlink();
+      delete decref;
+      num_removed += 2;
+    }
+  }
+  return num_removed;
+}
+
 void optimizeLongDecrefRuns(Function& irfunc) {
   constexpr int kMinimumNumberOfDecrefsToOptimize = 4;
 
@@ -1291,6 +1426,8 @@ void RefcountInsertion::Run(Function& func) {
   // every pass.
   CleanCFG::RemoveTrampolineBlocks(&func.cfg);
 
+  func.num_refcount_ops_eliminated += cancelRefcountPairs(func);
+
   // Optimize long decref runs
   optimizeLongDecrefRuns(func);
 }
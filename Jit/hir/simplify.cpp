@@ -588,6 +588,20 @@ Register* simplifyVectorCall(Env& env, const VectorCall* instr) {
   return nullptr;
 }
 
+Register* simplifyFormatValue(Env& env, const FormatValue* instr) {
+  Register* fmt_spec = instr->GetOperand(0);
+  Register* value = instr->GetOperand(1);
+  int conversion = instr->conversion();
+  // Formatting an exact str with no spec and no (or a str()) conversion is the
+  // identity.
+  if (fmt_spec->isA(TNullptr) && value->isA(TUnicodeExact) &&
+      (conversion == FVC_NONE || conversion == FVC_STR)) {
+    env.emit<UseType>(value, TUnicodeExact);
+    return value;
+  }
+  return nullptr;
+}
+
 Register* simplifyInstr(Env& env, const Instr* instr) {
   switch (instr->opcode()) {
     case Opcode::kCheckVar:
@@ -610,6 +624,9 @@ Register* simplifyInstr(Env& env, const Instr* instr) {
       return simplifyCondBranchCheckType(
           env, static_cast<const CondBranchCheckType*>(instr));
 
+    case Opcode::kFormatValue:
+      return simplifyFormatValue(env, static_cast<const FormatValue*>(instr));
+
     case Opcode::kIntConvert:
       return simplifyIntConvert(env, static_cast<const IntConvert*>(instr));
 
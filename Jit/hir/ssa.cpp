@@ -554,6 +554,7 @@ Type outputType(
       return get_op_type(0) & type;
     }
 
+    case Opcode::kBuildStringFused:
     case Opcode::kUnicodeRepeat: {
       return TUnicodeExact;
     }
@@ -747,4 +747,74 @@ void notifyICsTypeChanged(BorrowedRef<PyTypeObject> type) {
   ltac_watcher.typeChanged(type);
 }
 
+// Equivalent of the DK_ENTRIES() macro in dictobject.c.
+static PyDictKeyEntry* dictKeysEntries(PyDictKeysObject* keys) {
+  Py_ssize_t size = keys->dk_size;
+  Py_ssize_t index_size = sizeof(int64_t);
+  if (size <= 0xff) {
+    index_size = 1;
+  } else if (size <= 0xffff) {
+    index_size = 2;
+  } else if (size <= 0xffffffff) {
+    index_size = 4;
+  }
+  return reinterpret_cast<PyDictKeyEntry*>(
+      &keys->dk_indices[size * index_size]);
+}
+
+PyObject*
+DictSubscrCache::invoke(DictSubscrCache* cache, PyObject* dict, PyObject* key) {
+  auto mp = reinterpret_cast<PyDictObject*>(dict);
+  PyDictKeysObject* keys = mp->ma_keys;
+  if (keys == cache->keys_ &&
+      reinterpret_cast<void*>(keys->dk_lookup) == cache->lookup_ &&
+      cache->index_ < keys->dk_nentries) {
+    PyDictKeyEntry* entry = &dictKeysEntries(keys)[cache->index_];
+    if (entry->me_key == key) {
+      PyObject* value = mp->ma_values == nullptr
+          ? entry->me_value
+          : mp->ma_values[cache->index_];
+      if (value != nullptr) {
+        Py_INCREF(value);
+        return value;
+      }
+    }
+  }
+  return cache->invokeSlowPath(mp, key);
+}
+
+PyObject* DictSubscrCache::invokeSlowPath(PyDictObject* dict, PyObject* key) {
+  JIT_DCHECK(PyDict_CheckExact(dict), "expected an exact dict");
+  JIT_DCHECK(PyUnicode_CheckExact(key), "expected an exact str key");
+  Py_hash_t hash = reinterpret_cast<PyASCIIObject*>(key)->hash;
+  if (hash == -1) {
+    hash = PyObject_Hash(key);
+    if (hash == -1) {
+      return nullptr;
+    }
+  }
+  auto dictobj = reinterpret_cast<PyObject*>(dict);
+  // The lookup may run arbitrary code (__eq__ of other keys, resolving
+  // deferred values), so keep the dict alive.
+  Ref<> guard(dictobj);
+  PyDictKeysObject* keys = dict->ma_keys;
+  PyObject* value = nullptr;
+  Py_ssize_t ix = keys->dk_lookup(dict, key, hash, &value, 1);
+  if (ix == DKIX_ERROR || ix == DKIX_VALUE_ERROR) {
+    return nullptr;
+  }
+  if (ix == DKIX_EMPTY || value == nullptr) {
+    _PyErr_SetKeyError(key);
+    return nullptr;
+  }
+  if (dict->ma_keys == keys && !_PyDict_HasDeferredObjects(dictobj) &&
+      dictKeysEntries(keys)[ix].me_key == key) {
+    keys_ = keys;
+    lookup_ = reinterpret_cast<void*>(keys->dk_lookup);
+    index_ = ix;
+  }
+  Py_INCREF(value);
+  return value;
+}
+
 } // namespace jit
@@ -171,6 +171,34 @@ class LoadTypeAttrCache {
   void reset();
 };
 
+// A cache for DictSubscr instructions whose key is a constant, interned str.
+//
+// Remembers the keys object of the last dict that the key was found in and the
+// index of the key's entry in it. On subsequent lookups in a dict that shares
+// that keys object, the entry is checked by pointer identity and its value is
+// returned without hashing or probing. All fields are borrowed and only
+// dereferenced after comparing against the dict's live keys object.
+class DictSubscrCache {
+ public:
+  DictSubscrCache() = default;
+
+  // Returns a new reference to the value, or nullptr with KeyError (or
+  // whatever the lookup raised) set.
+  static PyObject* invoke(DictSubscrCache* cache, PyObject* dict, PyObject* key);
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(DictSubscrCache);
+
+  PyObject* invokeSlowPath(PyDictObject* dict, PyObject* key);
+
+  PyDictKeysObject* keys_{nullptr};
+  // Lookup function of keys_ when the cache was filled. This changes when a
+  // deferred (lazily imported) value is stored in the dict, which must then be
+  // resolved by the full lookup.
+  void* lookup_{nullptr};
+  Py_ssize_t index_{0};
+};
+
 struct GlobalCacheKey {
   // builtins and globals are weak references; the invalidation code is
   // responsible for erasing any relevant keys when a dict is freed.
@@ -419,12 +419,14 @@ void _PyJITContext_FuncModified(
     _PyJITContext* ctx,
     BorrowedRef<PyFunctionObject> func) {
   deopt_func(ctx, func);
+  jit::Runtime::get()->notifyFunctionModified(func);
 }
 
 void _PyJITContext_FuncDestroyed(
     _PyJITContext* ctx,
     BorrowedRef<PyFunctionObject> func) {
   ctx->compiled_funcs.erase(func);
+  jit::Runtime::get()->forgetFunction(func);
 }
 
 void _PyJITContext_TypeModified(
@@ -496,6 +498,18 @@ int _PyJITContext_GetNumInlinedFunctions(
   return jitfunc->GetNumInlinedFunctions();
 }
 
+int _PyJITContext_GetNumRefcountOpsEliminated(
+    _PyJITContext* ctx,
+    BorrowedRef<PyFunctionObject> func) {
+  jit::CompiledFunction* jitfunc =
+      lookupCompiledCode(ctx, func->func_code, func->func_globals);
+  if (jitfunc == nullptr) {
+    return -1;
+  }
+
+  return jitfunc->GetNumRefcountOpsEliminated();
+}
+
 PyObject* _PyJITContext_GetCompiledFunctions(_PyJITContext* ctx) {
   auto funcs = Ref<>::steal(PyList_New(0));
   if (funcs == nullptr) {
@@ -235,6 +235,16 @@ int _PyJITContext_GetNumInlinedFunctions(
     _PyJITContext* ctx,
     BorrowedRef<PyFunctionObject> func);
 
+/*
+ * Returns the number of Incref/Decref instructions that were optimized away
+ * after refcount insertion in a specified JIT-compiled function.
+ *
+ * Returns -1 if an error occurred.
+ */
+int _PyJITContext_GetNumRefcountOpsEliminated(
+    _PyJITContext* ctx,
+    BorrowedRef<PyFunctionObject> func);
+
 /*
  * Return a list of functions that are currently JIT-compiled.
  *
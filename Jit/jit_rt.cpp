@@ -1813,6 +1813,95 @@ PyObject* JITRT_BuildString(
   return _PyUnicode_JoinArray(empty, args, nargs);
 }
 
+// Write the decimal representation of value into the end of buf, returning a
+// pointer to the first character.
+static char* formatLongLong(long long value, char* buf_end) {
+  unsigned long long abs_value = value < 0
+      ? 0ULL - static_cast<unsigned long long>(value)
+      : static_cast<unsigned long long>(value);
+  char* p = buf_end;
+  do {
+    *--p = '0' + (abs_value % 10);
+    abs_value /= 10;
+  } while (abs_value != 0);
+  if (value < 0) {
+    *--p = '-';
+  }
+  return p;
+}
+
+PyObject* JITRT_BuildStringFused(
+    void* /*unused*/,
+    PyObject** args,
+    size_t nargsf,
+    void* /*unused*/) {
+  size_t nargs = PyVectorcall_NARGS(nargsf);
+  // Enough room for the digits and sign of any long long.
+  constexpr size_t kMaxDigits = 24;
+
+  // Compute the length and widest character kind of the result up front so we
+  // can allocate it once.
+  Py_ssize_t length = 0;
+  Py_UCS4 maxchar = 0;
+  for (size_t i = 0; i < nargs; i++) {
+    PyObject* piece = args[i];
+    if (PyUnicode_CheckExact(piece)) {
+      if (PyUnicode_READY(piece) == -1) {
+        return nullptr;
+      }
+      length += PyUnicode_GET_LENGTH(piece);
+      maxchar = std::max<Py_UCS4>(maxchar, PyUnicode_MAX_CHAR_VALUE(piece));
+      continue;
+    }
+    JIT_DCHECK(PyLong_CheckExact(piece), "Expected exact str or int");
+    int overflow;
+    long long value = PyLong_AsLongLongAndOverflow(piece, &overflow);
+    if (overflow) {
+      // Ints that don't fit in a machine word are rare enough that we let the
+      // generic machinery handle the whole string.
+      std::vector<Ref<>> strs;
+      std::vector<PyObject*> str_args;
+      strs.reserve(nargs);
+      str_args.reserve(nargs);
+      for (size_t j = 0; j < nargs; j++) {
+        strs.emplace_back(Ref<>::steal(PyObject_Str(args[j])));
+        if (strs.back() == nullptr) {
+          return nullptr;
+        }
+        str_args.push_back(strs.back());
+      }
+      return JITRT_BuildString(nullptr, str_args.data(), nargs, nullptr);
+    }
+    char buf[kMaxDigits];
+    length += buf + kMaxDigits - formatLongLong(value, buf + kMaxDigits);
+    maxchar = std::max<Py_UCS4>(maxchar, '9');
+  }
+
+  PyObject* result = PyUnicode_New(length, maxchar);
+  if (result == nullptr || length == 0) {
+    return result;
+  }
+  int kind = PyUnicode_KIND(result);
+  void* data = PyUnicode_DATA(result);
+  Py_ssize_t pos = 0;
+  for (size_t i = 0; i < nargs; i++) {
+    PyObject* piece = args[i];
+    if (PyUnicode_CheckExact(piece)) {
+      Py_ssize_t piece_len = PyUnicode_GET_LENGTH(piece);
+      _PyUnicode_FastCopyCharacters(result, pos, piece, 0, piece_len);
+      pos += piece_len;
+      continue;
+    }
+    char buf[kMaxDigits];
+    char* digits = formatLongLong(PyLong_AsLongLong(piece), buf + kMaxDigits);
+    for (; digits != buf + kMaxDigits; digits++) {
+      PyUnicode_WRITE(kind, data, pos++, *digits);
+    }
+  }
+  JIT_DCHECK(pos == length, "Miscomputed fused string length");
+  return result;
+}
+
 JITRT_StaticCallReturn
 JITRT_CompileFunction(PyFunctionObject* func, PyObject** args, bool* compiled) {
   void* no_error = (void*)1;
@@ -440,6 +440,16 @@ PyObject* JITRT_BuildString(
     size_t nargsf,
     void* /*unused*/);
 
+/*
+ * Concatenate exact strs and the decimal representations of exact ints from
+ * args into a single newly allocated string.
+ */
+PyObject* JITRT_BuildStringFused(
+    void* /*unused*/,
+    PyObject** args,
+    size_t nargsf,
+    void* /*unused*/);
+
 // Per-function entry point function to resume a JIT generator. Arguments are:
 //   - Generator instance to be resumed.
 //   - A value to send in or NULL to raise the current global error on resume.
@@ -2161,6 +2161,17 @@ LIRGenerator::TranslatedBlock LIRGenerator::TranslateOneBasicBlock(
       }
       case Opcode::kDictSubscr: {
         auto instr = static_cast<const DictSubscr*>(&i);
+        Type key_type = instr->GetOperand(1)->type();
+        if (key_type.hasValueSpec(TUnicodeExact) &&
+            PyUnicode_CHECK_INTERNED(key_type.objectSpec())) {
+          bbb.AppendCall(
+              instr->GetOutput(),
+              jit::DictSubscrCache::invoke,
+              Runtime::get()->allocateDictSubscrCache(),
+              instr->GetOperand(0),
+              instr->GetOperand(1));
+          break;
+        }
         bbb.AppendCall(
             instr->GetOutput(),
             PyDict_Type.tp_as_mapping->mp_subscript,
@@ -2577,6 +2588,23 @@ LIRGenerator::TranslatedBlock LIRGenerator::TranslateOneBasicBlock(
         bbb.AppendCode(s);
         break;
       }
+      case Opcode::kBuildStringFused: {
+        const auto& instr = static_cast<const BuildStringFused&>(i);
+
+        // Same calling convention as BuildString above.
+        std::string s = fmt::format(
+            "Vectorcall {}, {}, 0, 0",
+            instr.dst(),
+            reinterpret_cast<uint64_t>(JITRT_BuildStringFused));
+        for (size_t i = 0; i < instr.NumOperands(); i++) {
+          s += fmt::format(", {}", instr.GetOperand(i));
+        }
+
+        s += ", 0";
+
+        bbb.AppendCode(s);
+        break;
+      }
       case Opcode::kWaitHandleLoadWaiter: {
         const auto& instr = static_cast<const WaitHandleLoadWaiter&>(i);
         bbb.AppendCode(
@@ -929,6 +929,14 @@ static PyObject* get_num_inlined_functions(PyObject*, PyObject* func) {
   return PyLong_FromLong(size);
 }
 
+static PyObject* get_num_refcount_ops_eliminated(PyObject*, PyObject* func) {
+  if (jit_ctx == NULL) {
+    return PyLong_FromLong(0);
+  }
+  int num = _PyJITContext_GetNumRefcountOpsEliminated(jit_ctx, func);
+  return PyLong_FromLong(num);
+}
+
 static PyObject* mlock_profiler_dependencies(PyObject* /* self */, PyObject*) {
   if (jit_ctx == NULL) {
     Py_RETURN_NONE;
@@ -969,7 +977,7 @@ Ref<> make_deopt_stats() {
 
   for (auto& pair : runtime->deoptStats()) {
     const DeoptMetadata& meta = runtime->getDeoptMetadata(pair.first);
-    const DeoptFrameMetadata& frame_meta = meta.frame_meta[meta.inline_depth()];
+    const DeoptFrameMetadata& frame_meta = meta.innermostFrame();
     const DeoptStat& stat = pair.second;
     BorrowedRef<PyCodeObject> code = frame_meta.code;
 
@@ -1162,6 +1170,31 @@ static PyObject* get_allocator_stats(PyObject*, PyObject*) {
   return stats.release();
 }
 
+static PyObject* get_deopt_metadata_stats(PyObject*, PyObject*) {
+  auto stats = Ref<>::steal(PyDict_New());
+  if (stats == nullptr) {
+    return nullptr;
+  }
+  Runtime* runtime = Runtime::get();
+  InternedDeoptStats interned = internedDeoptStats();
+  auto set_item = [&](const char* key, std::size_t value) {
+    auto value_obj = Ref<>::steal(PyLong_FromSize_t(value));
+    return value_obj != nullptr &&
+        PyDict_SetItemString(stats, key, value_obj) == 0;
+  };
+  if (!set_item("num_deopt_metadata", runtime->numDeoptMetadata()) ||
+      !set_item("deopt_metadata_bytes", runtime->deoptMetadataBytes()) ||
+      !set_item("num_frames", interned.num_frames) ||
+      !set_item("num_unique_frames", interned.num_unique_frames) ||
+      !set_item("unique_frame_bytes", interned.frame_bytes) ||
+      !set_item("num_index_lists", interned.num_index_lists) ||
+      !set_item("num_unique_index_lists", interned.num_unique_index_lists) ||
+      !set_item("unique_index_list_bytes", interned.index_list_bytes)) {
+    return nullptr;
+  }
+  return stats.release();
+}
+
 static PyObject* is_hir_inliner_enabled(PyObject* /* self */, PyObject*) {
   int result = _PyJIT_IsHIRInlinerEnabled();
   if (result) {
@@ -1267,6 +1300,12 @@ static PyMethodDef jit_methods[] = {
      get_allocator_stats,
      METH_NOARGS,
      "Return stats from the code allocator as a dictionary."},
+    {"get_deopt_metadata_stats",
+     get_deopt_metadata_stats,
+     METH_NOARGS,
+     "Return the number and memory usage, in bytes, of deopt metadata and the "
+     "frame metadata and live value indices shared between them, as a "
+     "dictionary."},
     {"is_hir_inliner_enabled",
      is_hir_inliner_enabled,
      METH_NOARGS,
@@ -1283,6 +1322,11 @@ static PyMethodDef jit_methods[] = {
      get_num_inlined_functions,
      METH_O,
      "Return the number of inline sites in this function."},
+    {"get_num_refcount_ops_eliminated",
+     get_num_refcount_ops_eliminated,
+     METH_O,
+     "Return the number of Incref/Decref instructions that were optimized "
+     "away in this function."},
     {"mlock_profiler_dependencies",
      mlock_profiler_dependencies,
      METH_NOARGS,
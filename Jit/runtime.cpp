@@ -155,6 +155,22 @@ DeoptMetadata& Runtime::getDeoptMetadata(std::size_t id) {
   return deopt_metadata_[id];
 }
 
+std::size_t Runtime::numDeoptMetadata() {
+  ThreadedCompileSerialize guard;
+  return deopt_metadata_.size();
+}
+
+std::size_t Runtime::deoptMetadataBytes() {
+  ThreadedCompileSerialize guard;
+  std::size_t bytes =
+      (deopt_metadata_.capacity() - deopt_metadata_.size()) *
+      sizeof(DeoptMetadata);
+  for (const DeoptMetadata& meta : deopt_metadata_) {
+    bytes += meta.memoryUsage();
+  }
+  return bytes;
+}
+
 void Runtime::recordDeopt(std::size_t idx, PyObject* guilty_value) {
   DeoptStat& stat = deopt_stats_[idx];
   stat.count++;
@@ -175,6 +191,48 @@ TypeProfiles& Runtime::typeProfiles() {
   return type_profiles_;
 }
 
+void Runtime::setInferredReturnType(
+    BorrowedRef<PyCodeObject> code,
+    hir::Type type) {
+  ThreadedCompileSerialize guard;
+  auto result = inferred_return_types_.emplace(code, type);
+  if (!result.second) {
+    result.first->second |= type;
+  }
+}
+
+hir::Type Runtime::inferredReturnType(BorrowedRef<PyCodeObject> code) {
+  ThreadedCompileSerialize guard;
+  auto it = inferred_return_types_.find(code);
+  return it == inferred_return_types_.end() ? hir::TObject : it->second;
+}
+
+void Runtime::watchFunctionModified(
+    BorrowedRef<PyFunctionObject> func,
+    DeoptPatcher* patcher) {
+  ThreadedCompileSerialize guard;
+  function_modified_patchers_[func].push_back(patcher);
+}
+
+void Runtime::notifyFunctionModified(BorrowedRef<PyFunctionObject> func) {
+  auto it = function_modified_patchers_.find(func);
+  if (it == function_modified_patchers_.end()) {
+    return;
+  }
+  for (DeoptPatcher* patcher : it->second) {
+    patcher->patch();
+  }
+  function_modified_patchers_.erase(it);
+}
+
+void Runtime::forgetFunction(BorrowedRef<PyFunctionObject> func) {
+  function_modified_patchers_.erase(func);
+}
+
+void FunctionModifiedDeoptPatcher::init() {
+  Runtime::get()->watchFunctionModified(func_, this);
+}
+
 void Runtime::setGuardFailureCallback(Runtime::GuardFailureCallback cb) {
   guard_failure_callback_ = cb;
 }
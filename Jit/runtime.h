@@ -4,6 +4,7 @@
 #include "Jit/containers.h"
 #include "Jit/debug_info.h"
 #include "Jit/deopt.h"
+#include "Jit/deopt_patcher.h"
 #include "Jit/fixed_type_profiler.h"
 #include "Jit/inline_cache.h"
 #include "Jit/jit_rt.h"
@@ -246,6 +247,20 @@ struct CodeProfile {
 
 using TypeProfiles = std::unordered_map<Ref<PyCodeObject>, CodeProfile>;
 
+// A DeoptPatcher that invalidates compiled code when a function it depends on
+// is modified (e.g. has its __code__ replaced).
+class FunctionModifiedDeoptPatcher : public DeoptPatcher {
+ public:
+  explicit FunctionModifiedDeoptPatcher(BorrowedRef<PyFunctionObject> func)
+      : func_(func) {}
+
+ protected:
+  void init() override;
+
+ private:
+  BorrowedRef<PyFunctionObject> func_;
+};
+
 // Runtime owns all metadata created by the JIT.
 class Runtime {
  public:
@@ -296,6 +311,11 @@ class Runtime {
   std::size_t addDeoptMetadata(DeoptMetadata&& deopt_meta);
   DeoptMetadata& getDeoptMetadata(std::size_t id);
 
+  // Number of DeoptMetadatas added so far, and the approximate number of bytes
+  // they occupy, not including interned frame metadata.
+  std::size_t numDeoptMetadata();
+  std::size_t deoptMetadataBytes();
+
   // Record that a deopt of the given index happened at runtime, with an
   // optional guilty value.
   void recordDeopt(std::size_t idx, PyObject* guilty_value);
@@ -306,6 +326,27 @@ class Runtime {
 
   TypeProfiles& typeProfiles();
 
+  // Record the type of every value returned by the compiled code for the
+  // given code object, for use when compiling its callers. Only types that
+  // don't depend on speculation in the compiled code should be recorded, since
+  // the same type must also hold if the code deopts part of the way through.
+  void setInferredReturnType(BorrowedRef<PyCodeObject> code, hir::Type type);
+
+  // Return the recorded return type for the given code object, or TObject if
+  // nothing is known.
+  hir::Type inferredReturnType(BorrowedRef<PyCodeObject> code);
+
+  // Patch the given patcher the next time func is modified.
+  void watchFunctionModified(
+      BorrowedRef<PyFunctionObject> func,
+      DeoptPatcher* patcher);
+
+  // Patch all patchers watching func. Called when func is modified.
+  void notifyFunctionModified(BorrowedRef<PyFunctionObject> func);
+
+  // Forget all patchers watching func. Called when func is destroyed.
+  void forgetFunction(BorrowedRef<PyFunctionObject> func);
+
   using GuardFailureCallback = std::function<void(const DeoptMetadata&)>;
 
   // Add a function to be called when deoptimization occurs due to guard
@@ -344,6 +385,10 @@ class Runtime {
     return store_attr_caches_.allocate();
   }
 
+  DictSubscrCache* allocateDictSubscrCache() {
+    return dict_subscr_caches_.allocate();
+  }
+
   // Some profilers need to walk the code_rt->code->qualname chain for jitted
   // functions on the call stack. The JIT rarely touches this memory and, as a
   // result, the OS may page it out. Out of process profilers (i.e. those that
@@ -370,6 +415,7 @@ class Runtime {
   SlabArena<LoadTypeAttrCache> load_type_attr_caches_;
   SlabArena<JITRT_LoadMethodCache> load_method_caches_;
   SlabArena<StoreAttrCache> store_attr_caches_;
+  SlabArena<DictSubscrCache> dict_subscr_caches_;
   SlabArena<void*> pointer_caches_;
 
   GlobalCacheMap global_caches_;
@@ -381,6 +427,15 @@ class Runtime {
 
   TypeProfiles type_profiles_;
 
+  // Return types of compiled code, keyed by code objects that are kept alive
+  // by their CodeRuntimes.
+  UnorderedMap<BorrowedRef<PyCodeObject>, hir::Type> inferred_return_types_;
+
+  // DeoptPatchers invalidating code that relies on a function being
+  // unmodified.
+  UnorderedMap<BorrowedRef<PyFunctionObject>, std::vector<DeoptPatcher*>>
+      function_modified_patchers_;
+
   // References to Python objects held by this Runtime
   std::unordered_set<Ref<PyObject>> references_;
   std::vector<std::unique_ptr<DeoptPatcher>> deopt_patchers_;
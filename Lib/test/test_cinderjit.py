@@ -2970,7 +2970,124 @@ class DeleteFastTests(unittest.TestCase):
             self.assertEqual(self._del_ex_raise(), 42)
 
 
+@unittest.skipIf(not cinderjit, "JIT-specific metadata")
+class DeoptMetadataStatsTests(unittest.TestCase):
+    def test_identical_frames_are_shared(self):
+        def f(a, b):
+            return a.x + b.x + a.y + b.y
+
+        before = cinderjit.get_deopt_metadata_stats()
+        cinderjit.force_compile(f)
+        after = cinderjit.get_deopt_metadata_stats()
+        self.assertGreater(after["num_deopt_metadata"], before["num_deopt_metadata"])
+        self.assertGreater(after["deopt_metadata_bytes"], before["deopt_metadata_bytes"])
+        new_frames = after["num_frames"] - before["num_frames"]
+        new_unique = after["num_unique_frames"] - before["num_unique_frames"]
+        self.assertGreater(new_frames, 0)
+        self.assertLessEqual(new_unique, new_frames)
+        # Every guard in f sees the same locals.
+        new_lists = after["num_index_lists"] - before["num_index_lists"]
+        new_unique_lists = (
+            after["num_unique_index_lists"] - before["num_unique_index_lists"]
+        )
+        self.assertLess(new_unique_lists, new_lists)
+
+
+class FStringTests(unittest.TestCase):
+    def test_int_and_str_pieces(self):
+        @unittest.failUnlessJITCompiled
+        def f():
+            neg = -9223372036854775808
+            zero = 0
+            word = "caf\u00e9"
+            return f"<{neg}:{zero}:{word!s}:{12345!r}>"
+
+        self.assertEqual(f(), "<-9223372036854775808:0:caf\u00e9:12345>")
+
+    def test_wide_chars(self):
+        @unittest.failUnlessJITCompiled
+        def f():
+            n = 42
+            s = "\U0001f600"
+            return f"{s}{n}{s}"
+
+        self.assertEqual(f(), "\U0001f600" + "42" + "\U0001f600")
+
+    def test_big_int_piece(self):
+        @unittest.failUnlessJITCompiled
+        def f():
+            big = 2 ** 100
+            return f"x{big}y"
+
+        self.assertEqual(f(), f"x{2 ** 100}y")
+
+    def test_empty_pieces(self):
+        @unittest.failUnlessJITCompiled
+        def f():
+            a = ""
+            b = ""
+            return f"{a}{b}"
+
+        self.assertEqual(f(), "")
+
+
+def _return_type_callee():
+    return 42
+
+
+def _return_type_caller():
+    return _return_type_callee() + 1
+
+
+class CallReturnTypeTests(unittest.TestCase):
+    def test_callee_code_replaced(self):
+        if cinderjit:
+            cinderjit.force_compile(_return_type_callee)
+            cinderjit.force_compile(_return_type_caller)
+        self.assertEqual(_return_type_caller(), 43)
+
+        orig_code = _return_type_callee.__code__
+        _return_type_callee.__code__ = (lambda: 1.5).__code__
+        try:
+            self.assertEqual(_return_type_caller(), 2.5)
+        finally:
+            _return_type_callee.__code__ = orig_code
+        self.assertEqual(_return_type_caller(), 43)
+
+
+_dict_subscr_config = {"key": 1, "other": 2}
+
+
+def _dict_subscr_const_key():
+    return _dict_subscr_config["key"]
+
+
 class DictSubscrTests(unittest.TestCase):
+    def test_constant_key_sees_mutations(self):
+        if cinderjit:
+            cinderjit.force_compile(_dict_subscr_const_key)
+        config = _dict_subscr_config
+        try:
+            self.assertEqual(_dict_subscr_const_key(), 1)
+            self.assertEqual(_dict_subscr_const_key(), 1)
+            config["key"] = 3
+            self.assertEqual(_dict_subscr_const_key(), 3)
+            del config["key"]
+            with self.assertRaises(KeyError):
+                _dict_subscr_const_key()
+            config["key"] = 4
+            self.assertEqual(_dict_subscr_const_key(), 4)
+            # Force a resize, which allocates a new keys object.
+            for i in range(100):
+                config[f"k{i}"] = i
+            self.assertEqual(_dict_subscr_const_key(), 4)
+            config.clear()
+            with self.assertRaises(KeyError):
+                _dict_subscr_const_key()
+        finally:
+            config.clear()
+            config.update({"key": 1, "other": 2})
+
     def test_custom_class(self):
         class C:
             def __init__(self, value):
@@ -28,7 +28,8 @@ class DeoptPatcherTest : public RuntimeTest {
         func_size,
         stack_size,
         spill_stack_size,
-        /*num_inlined_functions=*/0);
+        /*num_inlined_functions=*/0,
+        /*num_refcount_ops_eliminated=*/0);
   }
 
  protected:
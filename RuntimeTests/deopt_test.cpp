@@ -66,7 +66,7 @@ def test(a, b):
   DeoptFrameMetadata dfm;
   dfm.localsplus = {0, 1};
   dfm.next_instr_offset = 0;
-  dm.frame_meta.push_back(dfm);
+  dm.frame_meta.push_back(&dfm);
   dm.code_rt = &code_rt;
 
   PyThreadState* tstate = PyThreadState_Get();
@@ -123,7 +123,7 @@ def test(a, b):
   dfm.localsplus = {0, 1};
   dfm.stack = {0, 1};
   dfm.next_instr_offset = 4;
-  dm.frame_meta.push_back(dfm);
+  dm.frame_meta.push_back(&dfm);
   dm.code_rt = &code_rt;
 
   PyThreadState* tstate = PyThreadState_Get();
@@ -182,7 +182,7 @@ def test(a, b):
   dfm.localsplus = {0, 1};
   dfm.stack = {0, 1};
   dfm.next_instr_offset = 4;
-  dm.frame_meta.push_back(dfm);
+  dm.frame_meta.push_back(&dfm);
   dm.code_rt = &code_rt;
 
   PyThreadState* tstate = PyThreadState_Get();
@@ -252,7 +252,7 @@ def test(num):
   dfm.localsplus = {0, 1};
   dfm.stack = {0, 2};
   dfm.next_instr_offset = 8;
-  dm.frame_meta.push_back(dfm);
+  dm.frame_meta.push_back(&dfm);
   dm.code_rt = &code_rt;
 
   PyThreadState* tstate = PyThreadState_Get();
@@ -313,7 +313,7 @@ def test(x, y):
     dfm.localsplus = {0};
     dfm.stack = {0};
     dfm.next_instr_offset = jump_index;
-    dm.frame_meta.push_back(dfm);
+    dm.frame_meta.push_back(&dfm);
     dm.code_rt = &code_rt;
 
     PyThreadState* tstate = PyThreadState_Get();
@@ -750,3 +750,44 @@ TEST_F(DeoptTest, ValueKind) {
   EXPECT_EQ(deoptValueKind(TLong), ValueKind::kObject);
   EXPECT_EQ(deoptValueKind(TNullptr), ValueKind::kObject);
 }
+
+TEST_F(DeoptTest, LiveValueIndicesRoundTrip) {
+  std::vector<int> values{0, 1, 2, -1, -1, 3, 200, 4, 100000, -1, 5};
+  LiveValueIndices indices{values};
+  ASSERT_EQ(indices.size(), values.size());
+
+  std::vector<int> decoded;
+  indices.forEach([&](std::size_t i, int value) {
+    EXPECT_EQ(i, decoded.size());
+    decoded.push_back(value);
+  });
+  EXPECT_EQ(decoded, values);
+  EXPECT_EQ(indices.at(6), 200);
+  EXPECT_EQ(indices.at(9), -1);
+
+  // Runs of consecutive indices take one byte each, and equal lists share
+  // their encoding.
+  LiveValueIndices consecutive{0, 1, 2, 3, 4, 5, 6, 7};
+  EXPECT_EQ(consecutive.encodedSize(), std::size_t{8});
+  EXPECT_EQ(consecutive, (LiveValueIndices{0, 1, 2, 3, 4, 5, 6, 7}));
+  EXPECT_NE(consecutive, (LiveValueIndices{0, 1, 2, 3, 4, 5, 6}));
+  EXPECT_EQ(LiveValueIndices{}.size(), std::size_t{0});
+  EXPECT_EQ(LiveValueIndices{}, LiveValueIndices{std::vector<int>{}});
+}
+
+TEST_F(DeoptTest, IdenticalFrameMetadataIsShared) {
+  auto make_frame = [](int next_instr_offset) {
+    DeoptFrameMetadata dfm;
+    dfm.localsplus = {0, -1, 1};
+    dfm.stack = {2};
+    dfm.next_instr_offset = next_instr_offset;
+    return dfm;
+  };
+  const DeoptFrameMetadata* a = internDeoptFrameMetadata(make_frame(4));
+  const DeoptFrameMetadata* b = internDeoptFrameMetadata(make_frame(4));
+  const DeoptFrameMetadata* c = internDeoptFrameMetadata(make_frame(6));
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+  EXPECT_EQ(a->localsplus.at(1), -1);
+  EXPECT_EQ(c->next_instr_offset, 6);
+}
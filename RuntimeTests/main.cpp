@@ -136,6 +136,7 @@ int main(int argc, char* argv[]) {
   register_json_test("RuntimeTests/hir_tests/json_test.txt");
   register_test(
       "RuntimeTests/hir_tests/builtin_load_method_elimination_test.txt");
+  register_test("RuntimeTests/hir_tests/build_string_fusion_test.txt");
 
   wchar_t* argv0 = Py_DecodeLocale(argv[0], nullptr);
   if (argv0 == nullptr) {